@@ -171,6 +171,11 @@
  */
 #define kMoca_MaxMocaNodes 16
 
+/**
+ * @brief Maximum number of SCMOD entries (one per ordered pair of distinct MoCA nodes) returned by `moca_getIfScmod()`.
+ */
+#define kMoca_MaxScmodEntries (kMoca_MaxMocaNodes * (kMoca_MaxMocaNodes - 1))
+
 /**
  * @brief Number of padding bytes added to a 6-byte MAC address to make it 18 bytes long. 
  *        This is required on platforms that handle MAC addresses as 18 bytes, while RDKB uses 6-byte MACs.
@@ -181,8 +186,99 @@
 #define STATUS_NO_NODE -2                /**< Status code: Specified MoCA node does not exist */
 #define STATUS_INVALID_PROBE -3          /**< Status code: HAL API called with invalid probe type */
 #define STATUS_INVALID_CHAN -4           /**< Status code: HAL API called with invalid channel */
+#define STATUS_NODE_NOT_FOUND -5         /**< Status code: Specified MoCA node is not known (unlike `STATUS_NO_NODE`, distinct from `STATUS_NOT_AVAILABLE`) */
+#define STATUS_BUSY -6                   /**< Status code: Operation already in progress, retry later (unlike `STATUS_INPROGRESS`, distinct from `STATUS_FAILURE`) */
+#define STATUS_INVALID_PARAM -7          /**< Status code: HAL API called with an invalid or out of range argument */
+#define STATUS_NO_RESOURCES -8           /**< Status code: A configured capacity limit has been reached */
 // TODO: Replace these status codes with strongly typed enums for better type safety and readability.
 
+/**
+ * @brief Version of the HAL interface declared by this header.
+ *
+ * Consumers compare these values with `VersionMajor` and `VersionMinor` of `moca_capabilities_t` to find out
+ * whether the loaded `libhal_moca.so` implements the APIs they were built against. The minor version is
+ * incremented with every backward compatible API addition:
+ *
+ * - 1.0: Initial interface.
+ * - 1.1: Capability discovery (`moca_GetCapabilities()`), pooled result arrays and HAL memory usage
+ *        (`moca_GetAssociatedDevicesPooled()`, `moca_GetHalMemoryUsage()`, ...), binary logging (`moca_LogRecord()`, ...),
+ *        background sampling (`moca_SamplerStart()`, ...), topology model (`moca_TopoGetLinkCapacity()`, ...),
+ *        ACA campaigns (`moca_startIfAcaCampaign()`, ...) and spectrum analyzer (`moca_SpectrumAnalyze()`, ...).
+ *        Within 1.1, `MOCA_CAP_*` flags tell which of these groups a library implements.
+ */
+#define MOCA_HAL_VERSION_MAJOR 1
+#define MOCA_HAL_VERSION_MINOR 1
+
+/**
+ * @brief Capability flags reported in `moca_capabilities_t.Capabilities` by `moca_GetCapabilities()`.
+ */
+#define MOCA_CAP_IF_STATUS          (1UL << 0)  /**< `moca_if_status_t` is reported in `moca_dynamic_info_t.Status` */
+#define MOCA_CAP_DYNAMIC_INFO       (1UL << 1)  /**< `moca_IfGetDynamicInfo()` is implemented */
+#define MOCA_CAP_FULL_MESH_RATES    (1UL << 2)  /**< `moca_GetFullMeshRates()` is implemented */
+#define MOCA_CAP_MESH_NPER_VLPER    (1UL << 3)  /**< `TxRateNper` and `TxRateVlper` of `moca_mesh_table_t` are populated (MoCA 2.x) */
+#define MOCA_CAP_FLOW_STATS         (1UL << 4)  /**< `moca_GetFlowStatistics()` is implemented */
+#define MOCA_CAP_SCMOD              (1UL << 5)  /**< `moca_getIfScmod()` is implemented */
+#define MOCA_CAP_ACA                (1UL << 6)  /**< ACA APIs (`moca_setIfAcaConfig()`, `moca_getIfAcaStatus()`, ...) are implemented */
+#define MOCA_CAP_64BIT_COUNTERS     (1UL << 7)  /**< Driver counters reported in `moca_stats_t` do not wrap at 2^32 (LP64 only; `ULONG` is 32 bits wide on 32-bit platforms) */
+#define MOCA_CAP_ASSOC_DEVICE_EVENTS (1UL << 8) /**< Callbacks registered with `moca_associatedDevice_callback_register()` are invoked */
+#define MOCA_CAP_MEM_USAGE          (1UL << 9)  /**< `moca_GetHalMemoryUsage()` reports HAL memory usage */
+#define MOCA_CAP_BINARY_LOG         (1UL << 10) /**< Binary logging APIs (`moca_LogRecord()`, ...) are implemented */
+#define MOCA_CAP_SAMPLER            (1UL << 11) /**< Background sampling APIs (`moca_SamplerStart()`, ...) are implemented */
+#define MOCA_CAP_TOPOLOGY           (1UL << 12) /**< Topology model APIs (`moca_TopoGetLinkCapacity()`, ...) are implemented */
+#define MOCA_CAP_ACA_CAMPAIGN       (1UL << 13) /**< ACA campaign APIs (`moca_startIfAcaCampaign()`, ...) are implemented */
+#define MOCA_CAP_SPECTRUM           (1UL << 14) /**< Spectrum analyzer APIs (`moca_SpectrumAnalyze()`, ...) are implemented */
+#define MOCA_CAP_POOLED_RESULTS     (1UL << 15) /**< `moca_GetAssociatedDevicesPooled()` and `moca_getIfScmodPooled()` return arrays from the HAL result pool */
+
+/**
+ * @brief Maximum number of arguments recorded in a single binary log entry.
+ */
+#define kMoca_LogMaxArgs 4
+
+/**
+ * @brief Minimum number of entries in each per-thread binary log ring.
+ */
+#define kMoca_LogRingEntries 1024
+
+#define kMoca_LogMaxRings 32                 /**< Maximum number of per-thread binary log rings allocated in a process */
+#define kMoca_LogFileMaxBytes (1024 * 1024)  /**< Size at which a process's binary log file is rotated */
+#define kMoca_LogDirMaxBytes (4 * 1024 * 1024) /**< Maximum total size of all binary log files in the log directory */
+
+#define kMoca_LogFileMagic 0x474F4C4D    /**< Magic number at the start of a binary log file ("MLOG" in little-endian byte order) */
+#define kMoca_LogFileVersion 1           /**< Version of the binary log file format described by `moca_log_file_header_t` */
+
+#define kMoca_SampleDefaultStatsMs 1000            /**< Default sampling interval for interface statistics and counters (1 s) */
+#define kMoca_SampleDefaultTopologyMs 30000        /**< Default sampling interval for dynamic info, associated devices, mesh rates and flows (30 s) */
+#define kMoca_SampleDefaultScmodMs 3600000         /**< Default sampling interval for SCMOD and ACA status (1 h) */
+#define kMoca_SampleDefaultBackoffInitialMs 1000   /**< Default initial retry delay after a failed sample */
+#define kMoca_SampleDefaultBackoffMaxMs 300000     /**< Default upper bound of the retry delay after repeated failures (5 min) */
+#define kMoca_SampleDefaultJitterPercent 10        /**< Default random jitter applied to retry delays, in percent */
+#define kMoca_SampleMinIntervalMs 100              /**< Shortest sampling interval a process may request */
+
+/**
+ * @brief Default difference between the two directions of a link, in percent of the faster direction,
+ *        above which the link is flagged as asymmetric by the topology model.
+ */
+#define kMoca_TopoDefaultAsymmetryPercent 30
+
+/**
+ * @brief Maximum number of links (unordered pairs of distinct MoCA nodes) reported by the topology model.
+ */
+#define kMoca_MaxTopoLinks (kMoca_MaxMocaNodes * (kMoca_MaxMocaNodes - 1) / 2)
+
+/**
+ * @brief Maximum number of ACA runs in a single campaign started with `moca_startIfAcaCampaign()`.
+ */
+#define kMoca_MaxAcaCampaignSteps 64
+
+#define kMoca_AcaProfileBins 512               /**< Number of bins in an ACA power profile (`ACAPowProfile` of `moca_aca_stat_t`) */
+#define kMoca_MaxSpectrumPeaks 16              /**< Maximum number of interferer peaks reported in `moca_spectrum_report_t` */
+#define kMoca_SpectrumDefaultHistory 32        /**< Default number of power profiles kept per channel for the rolling baseline */
+#define kMoca_SpectrumDefaultPercentile 50     /**< Default per-bin percentile used as baseline */
+#define kMoca_SpectrumDefaultAnomalyDb 6       /**< Default excess over the baseline, in dB, above which a bin is anomalous */
+#define kMoca_SpectrumDefaultPersistence 3     /**< Default number of consecutive anomalous profiles before an interferer is considered persistent */
+#define kMoca_MaxSpectrumChannels 32           /**< Maximum number of channels for which the spectrum analyzer can keep a history */
+#define kMoca_SpectrumDefaultChannels 16       /**< Default number of channels for which the spectrum analyzer keeps a history */
+
 /**********************************************************************
                 ENUMERATION DEFINITIONS
 **********************************************************************/
@@ -210,6 +306,122 @@ typedef enum
     PROBE_EVM   = 1   /**< EVM (Error Vector Magnitude) probe (transmits signal to measure signal quality) */
 }PROBE_TYPE;
 
+/**
+ * @brief Log levels, in descending order of severity.
+ */
+typedef enum
+{
+    MOCA_LOG_FATAL = 0,   /**< Critical conditions, typically system crashes or severe failures */
+    MOCA_LOG_ERROR = 1,   /**< Non-fatal error conditions that impede normal operation */
+    MOCA_LOG_WARNING = 2, /**< Potentially harmful situations */
+    MOCA_LOG_NOTICE = 3,  /**< Important but not error-level events */
+    MOCA_LOG_INFO = 4,    /**< General informational messages */
+    MOCA_LOG_DEBUG = 5,   /**< Detailed information useful when diagnosing problems */
+    MOCA_LOG_TRACE = 6    /**< Fine-grained tracing of the internal flow */
+} moca_log_level_t;
+
+/**
+ * @brief Identifiers of the HAL calls recorded in binary log entries.
+ *
+ * Values are part of the binary log file format and must not be renumbered; new calls are appended.
+ */
+typedef enum
+{
+    MOCA_CALL_None = 0,                   /**< Entry not associated with a HAL call */
+    MOCA_CALL_GetIfConfig = 1,            /**< `moca_GetIfConfig()` */
+    MOCA_CALL_SetIfConfig = 2,            /**< `moca_SetIfConfig()` */
+    MOCA_CALL_IfGetDynamicInfo = 3,       /**< `moca_IfGetDynamicInfo()` */
+    MOCA_CALL_IfGetStaticInfo = 4,        /**< `moca_IfGetStaticInfo()` */
+    MOCA_CALL_IfGetStats = 5,             /**< `moca_IfGetStats()` */
+    MOCA_CALL_GetNumAssociatedDevices = 6,/**< `moca_GetNumAssociatedDevices()` */
+    MOCA_CALL_IfGetExtCounter = 7,        /**< `moca_IfGetExtCounter()` */
+    MOCA_CALL_IfGetExtAggrCounter = 8,    /**< `moca_IfGetExtAggrCounter()` */
+    MOCA_CALL_GetMocaCPEs = 9,            /**< `moca_GetMocaCPEs()` */
+    MOCA_CALL_GetAssociatedDevices = 10,  /**< `moca_GetAssociatedDevices()` */
+    MOCA_CALL_FreqMaskToValue = 11,       /**< `moca_FreqMaskToValue()` */
+    MOCA_CALL_HardwareEquipped = 12,      /**< `moca_HardwareEquipped()` */
+    MOCA_CALL_GetFullMeshRates = 13,      /**< `moca_GetFullMeshRates()` */
+    MOCA_CALL_GetFlowStatistics = 14,     /**< `moca_GetFlowStatistics()` */
+    MOCA_CALL_GetResetCount = 15,         /**< `moca_GetResetCount()` */
+    MOCA_CALL_setIfAcaConfig = 16,        /**< `moca_setIfAcaConfig()` */
+    MOCA_CALL_getIfAcaConfig = 17,        /**< `moca_getIfAcaConfig()` */
+    MOCA_CALL_cancelIfAca = 18,           /**< `moca_cancelIfAca()` */
+    MOCA_CALL_getIfAcaStatus = 19,        /**< `moca_getIfAcaStatus()` */
+    MOCA_CALL_getIfScmod = 20,            /**< `moca_getIfScmod()` */
+    MOCA_CALL_FreeAssociatedDevices = 21, /**< `moca_FreeAssociatedDevices()` */
+    MOCA_CALL_freeIfScmod = 22,           /**< `moca_freeIfScmod()` */
+    MOCA_CALL_GetHalMemoryUsage = 23,     /**< `moca_GetHalMemoryUsage()` */
+    MOCA_CALL_GetCapabilities = 24,       /**< `moca_GetCapabilities()` */
+    MOCA_CALL_GetAssociatedDevicesPooled = 25, /**< `moca_GetAssociatedDevicesPooled()` */
+    MOCA_CALL_getIfScmodPooled = 26,      /**< `moca_getIfScmodPooled()` */
+    MOCA_CALL_SamplerSetSchedule = 27,    /**< `moca_SamplerSetSchedule()` */
+    MOCA_CALL_SamplerGetSchedule = 28,    /**< `moca_SamplerGetSchedule()` */
+    MOCA_CALL_SamplerRegisterSink = 29,   /**< `moca_SamplerRegisterSink()` */
+    MOCA_CALL_SamplerUnregisterSink = 30, /**< `moca_SamplerUnregisterSink()` */
+    MOCA_CALL_SamplerStart = 31,          /**< `moca_SamplerStart()` */
+    MOCA_CALL_SamplerStop = 32,           /**< `moca_SamplerStop()` */
+    MOCA_CALL_TopoUpdateDynamicInfo = 33, /**< `moca_TopoUpdateDynamicInfo()` */
+    MOCA_CALL_TopoUpdateMeshRates = 34,   /**< `moca_TopoUpdateMeshRates()` */
+    MOCA_CALL_TopoUpdateAssociatedDevices = 35, /**< `moca_TopoUpdateAssociatedDevices()` */
+    MOCA_CALL_TopoUpdatePncInfo = 36,     /**< `moca_TopoUpdatePncInfo()` */
+    MOCA_CALL_TopoSetAsymmetryThreshold = 37, /**< `moca_TopoSetAsymmetryThreshold()` */
+    MOCA_CALL_TopoGetLinkCapacity = 38,   /**< `moca_TopoGetLinkCapacity()` */
+    MOCA_CALL_TopoGetWeakestLinks = 39,   /**< `moca_TopoGetWeakestLinks()` */
+    MOCA_CALL_TopoGetAsymmetricLinks = 40, /**< `moca_TopoGetAsymmetricLinks()` */
+    MOCA_CALL_TopoRankNcCandidates = 41,  /**< `moca_TopoRankNcCandidates()` */
+    MOCA_CALL_TopoReset = 42,             /**< `moca_TopoReset()` */
+    MOCA_CALL_startIfAcaCampaign = 43,    /**< `moca_startIfAcaCampaign()` */
+    MOCA_CALL_cancelIfAcaCampaign = 44,   /**< `moca_cancelIfAcaCampaign()` */
+    MOCA_CALL_getIfAcaCampaignStatus = 45, /**< `moca_getIfAcaCampaignStatus()` */
+    MOCA_CALL_SpectrumSetConfig = 46,     /**< `moca_SpectrumSetConfig()` */
+    MOCA_CALL_SpectrumAddProfile = 47,    /**< `moca_SpectrumAddProfile()` */
+    MOCA_CALL_SpectrumGetPercentile = 48, /**< `moca_SpectrumGetPercentile()` */
+    MOCA_CALL_SpectrumAnalyze = 49,       /**< `moca_SpectrumAnalyze()` */
+    MOCA_CALL_SpectrumReset = 50,         /**< `moca_SpectrumReset()` */
+    MOCA_CALL_Vendor = 0x8000             /**< First identifier available for vendor-internal events */
+} moca_call_id_t;
+
+/**
+ * @brief Classes of data collected by the background sampler, one per HAL query API.
+ *
+ * A sink registered for a class receives the data returned by the corresponding API.
+ */
+typedef enum
+{
+    MOCA_SAMPLE_Stats = 0,               /**< `moca_IfGetStats()`, one `moca_stats_t` */
+    MOCA_SAMPLE_ExtCounter = 1,          /**< `moca_IfGetExtCounter()`, one `moca_mac_counters_t` */
+    MOCA_SAMPLE_ExtAggrCounter = 2,      /**< `moca_IfGetExtAggrCounter()`, one `moca_aggregate_counters_t` */
+    MOCA_SAMPLE_DynamicInfo = 3,         /**< `moca_IfGetDynamicInfo()`, one `moca_dynamic_info_t` */
+    MOCA_SAMPLE_AssociatedDevices = 4,   /**< `moca_GetAssociatedDevices()`, an array of `moca_associated_device_t` */
+    MOCA_SAMPLE_FullMeshRates = 5,       /**< `moca_GetFullMeshRates()`, an array of `moca_mesh_table_t` */
+    MOCA_SAMPLE_FlowStatistics = 6,      /**< `moca_GetFlowStatistics()`, an array of `moca_flow_table_t` */
+    MOCA_SAMPLE_Scmod = 7,               /**< `moca_getIfScmod()`, an array of `moca_scmod_stat_t` */
+    MOCA_SAMPLE_AcaStatus = 8,           /**< `moca_getIfAcaStatus()`, one `moca_aca_stat_t` */
+    MOCA_SAMPLE_Max = 9                  /**< Number of sample classes */
+} moca_sample_class_t;
+
+/**
+ * @brief PHY rate profiles used by the topology model.
+ */
+typedef enum
+{
+    MOCA_RATE_PROFILE_Default = 0,  /**< Unicast PHY rate (`TxRate` of `moca_mesh_table_t`) */
+    MOCA_RATE_PROFILE_Nper = 1,     /**< MoCA 2.x NPER PHY rate (`TxRateNper` of `moca_mesh_table_t`) */
+    MOCA_RATE_PROFILE_Vlper = 2     /**< MoCA 2.x VLPER PHY rate (`TxRateVlper` of `moca_mesh_table_t`) */
+} moca_rate_profile_t;
+
+/**
+ * @brief States of an ACA campaign.
+ */
+typedef enum
+{
+    MOCA_ACA_CAMPAIGN_Idle = 0,       /**< No campaign has been started on the interface */
+    MOCA_ACA_CAMPAIGN_Running = 1,    /**< A campaign is in progress */
+    MOCA_ACA_CAMPAIGN_Completed = 2,  /**< All runs of the last campaign have finished */
+    MOCA_ACA_CAMPAIGN_Cancelled = 3,  /**< The last campaign was cancelled with `moca_cancelIfAcaCampaign()` */
+    MOCA_ACA_CAMPAIGN_Failed = 4      /**< The last campaign was aborted because an ACA run could not be started */
+} moca_aca_campaign_state_t;
+
 #if 0
 typedef enum
 {
@@ -478,6 +690,200 @@ typedef struct
     BOOL ACATrapCompleted;     /**< Flag: TRUE if the power profile is ready, FALSE otherwise */
 } moca_aca_stat_t;
 
+/**
+ * @brief Memory usage of the MoCA HAL in the calling process, as reported by `moca_GetHalMemoryUsage()`.
+ *
+ * All sizes are in bytes. Arrays returned by the legacy `moca_GetAssociatedDevices()` and `moca_getIfScmod()`
+ * are released by the caller with `free()` and are therefore not included.
+ */
+typedef struct
+{
+    ULONG PoolSize;          /**< Current size of the result pool; it grows on demand up to the vendor-defined cap */
+    ULONG PoolUsage;         /**< Bytes of the result pool currently held by callers */
+    ULONG HeapUsage;         /**< Bytes currently allocated by the HAL from the system heap: pool fallbacks and internal state (log rings, topology model, spectrum history, ...) */
+    ULONG CurrentUsage;      /**< Total HAL memory footprint: `PoolSize` plus `HeapUsage` */
+    ULONG PeakUsage;         /**< Highest value of `CurrentUsage` observed since the HAL was loaded */
+    ULONG CurrentBlocks;     /**< Number of pooled result arrays currently held by callers */
+    ULONG AllocFailures;     /**< Number of pooled result allocations that exceeded the pool cap and fell back to the system heap */
+} moca_mem_usage_t;
+
+/**
+ * @brief Capabilities of the MoCA HAL implementation, as reported by `moca_GetCapabilities()`.
+ */
+typedef struct
+{
+    UINT VersionMajor;       /**< Major version of the HAL interface implemented by the library (compare with `MOCA_HAL_VERSION_MAJOR`) */
+    UINT VersionMinor;       /**< Minor version of the HAL interface implemented by the library (compare with `MOCA_HAL_VERSION_MINOR`) */
+    ULONG Capabilities;      /**< Bitmask of `MOCA_CAP_*` flags supported on this interface */
+} moca_capabilities_t;
+
+/**
+ * @brief A single binary log entry.
+ *
+ * Entries are recorded without any formatting and are converted to text only when decoded.
+ * All fields have a fixed width so that log files can be decoded on a host with a different word size.
+ */
+typedef struct
+{
+    unsigned long long Timestamp;               /**< Time of the event in nanoseconds of `CLOCK_MONOTONIC` */
+    unsigned long long Args[kMoca_LogMaxArgs];  /**< Call arguments or results; only the first `NumArgs` elements are valid */
+    UINT ThreadId;                              /**< Kernel thread ID of the recording thread */
+    UINT CallId;                                /**< HAL call that produced the entry (see `moca_call_id_t`) */
+    INT Status;                                 /**< Return value of the HAL call, or 0 if not applicable */
+    UCHAR Level;                                /**< Log level of the entry (see `moca_log_level_t`) */
+    UCHAR NumArgs;                              /**< Number of valid elements in `Args` (0 to `kMoca_LogMaxArgs`) */
+    UCHAR Reserved[2];                          /**< Reserved, set to 0 */
+} moca_log_entry_t;
+
+/**
+ * @brief Header written at the start of a binary log file, followed by a sequence of `moca_log_entry_t` records.
+ *
+ * Each process writes its own file, `moca_vendor_hal.<pid>.bin`, so a file always has exactly one writer and one header.
+ */
+typedef struct
+{
+    UINT Magic;                         /**< Always `kMoca_LogFileMagic` */
+    UINT Version;                       /**< File format version, `kMoca_LogFileVersion` */
+    UINT EntrySize;                     /**< Size in bytes of each `moca_log_entry_t` record in the file */
+    UINT ProcessId;                     /**< ID of the process that wrote the file */
+    unsigned long long MonotonicBase;   /**< `CLOCK_MONOTONIC` time in nanoseconds when the file was opened */
+    unsigned long long RealtimeBase;    /**< `CLOCK_REALTIME` time in nanoseconds when the file was opened */
+} moca_log_file_header_t;
+
+/**
+ * @brief Binary logging statistics, as reported by `moca_LogGetStats()`.
+ */
+typedef struct
+{
+    ULONG EntriesRecorded;   /**< Number of entries written into the per-thread rings */
+    ULONG EntriesDropped;    /**< Number of entries discarded because a ring was full or no ring was available for the thread */
+    ULONG EntriesFlushed;    /**< Number of entries written to the binary log file */
+    ULONG ActiveRings;       /**< Number of per-thread rings currently allocated (at most `kMoca_LogMaxRings`) */
+} moca_log_stats_t;
+
+/**
+ * @brief Sampling schedule of one data class on one interface.
+ */
+typedef struct
+{
+    moca_sample_class_t SampleClass; /**< Data class the schedule applies to */
+    BOOL Enabled;                    /**< Flag: TRUE if the class is sampled, FALSE otherwise */
+    ULONG IntervalMs;                /**< Interval between two samples, in milliseconds */
+    ULONG OffsetMs;                  /**< Phase of the first sample relative to `moca_SamplerStart()`, in milliseconds; 0 lets the sampler stagger the class automatically */
+    ULONG BackoffInitialMs;          /**< Retry delay after the first failed sample, in milliseconds; doubled on every further failure */
+    ULONG BackoffMaxMs;              /**< Upper bound of the retry delay, in milliseconds */
+    UINT JitterPercent;              /**< Random jitter applied to each retry delay, in percent of the delay (0-100) */
+} moca_sample_schedule_t;
+
+/**
+ * @brief A sample delivered to a sink registered with `moca_SamplerRegisterSink()`.
+ */
+typedef struct
+{
+    moca_sample_class_t SampleClass; /**< Data class of the sample; determines the element type of `pData` */
+    INT Status;                      /**< Return value of the HAL API that produced the sample */
+    unsigned long long Timestamp;    /**< Time the sample was taken, in nanoseconds of `CLOCK_MONOTONIC` */
+    ULONG Count;                     /**< Number of elements in `pData` (0 if `Status` is not `STATUS_SUCCESS`) */
+    const void *pData;               /**< Sampled data, valid only for the duration of the sink callback */
+} moca_sample_t;
+
+/**
+ * @brief Callback function type for receiving samples from the background sampler.
+ *
+ * @param ifIndex The index of the MoCA interface the sample was taken on.
+ * @param psample Pointer to the `moca_sample_t` describing the sample.
+ * @param userData The user data pointer passed to `moca_SamplerRegisterSink()`.
+ */
+typedef void (*moca_sample_sink_callback)(ULONG ifIndex, const moca_sample_t *psample, void *userData);
+
+/**
+ * @brief Capacity of the link between two MoCA nodes, as reported by the topology model.
+ */
+typedef struct
+{
+    ULONG TxNodeID;        /**< Transmitting node ID */
+    ULONG RxNodeID;        /**< Receiving node ID */
+    ULONG Rate;            /**< PHY rate from `TxNodeID` to `RxNodeID` under the requested profile (in Mbps) */
+    ULONG ReverseRate;     /**< PHY rate from `RxNodeID` to `TxNodeID` under the requested profile (in Mbps) */
+    ULONG BottleneckRate;  /**< Lower of `Rate` and `ReverseRate` (in Mbps) */
+    BOOL Asymmetric;       /**< Flag: TRUE if the two directions differ by more than the asymmetry threshold, FALSE otherwise */
+    BOOL Weakest;          /**< Flag: TRUE if `BottleneckRate` is the lowest of all links in the network, FALSE otherwise */
+} moca_topo_link_t;
+
+/**
+ * @brief A node ranked as Network Coordinator (NC) candidate by `moca_TopoRankNcCandidates()`.
+ */
+typedef struct
+{
+    ULONG NodeID;          /**< Node ID of the candidate */
+    ULONG MocaVersion;     /**< MoCA version supported by the node (e.g., 10, 11, 20) */
+    ULONG MinRate;         /**< Lowest PHY rate of all links to and from the node under the requested profile (in Mbps) */
+    ULONG AvgRate;         /**< Average PHY rate of all links to and from the node under the requested profile (in Mbps) */
+    BOOL PreferredNC;      /**< Flag: TRUE if the node is configured as preferred NC, FALSE otherwise */
+    BOOL IsNC;             /**< Flag: TRUE if the node is the current NC, FALSE otherwise */
+    BOOL IsBackupNC;       /**< Flag: TRUE if the node is the current backup NC, FALSE otherwise */
+} moca_topo_nc_candidate_t;
+
+/**
+ * @brief Progress of an ACA campaign, as reported by `moca_getIfAcaCampaignStatus()`.
+ */
+typedef struct
+{
+    moca_aca_campaign_state_t State;  /**< State of the current or last campaign */
+    INT NumSteps;                     /**< Number of ACA runs in the campaign */
+    INT NumCompleted;                 /**< Number of ACA runs that have finished, successfully or not */
+    INT CurrentStep;                  /**< Index of the ACA run in progress, or -1 if none */
+} moca_aca_campaign_status_t;
+
+/**
+ * @brief Callback function type invoked when an ACA campaign ends.
+ *
+ * @param interfaceIndex The index of the MoCA interface the campaign ran on.
+ * @param state Final state of the campaign (`MOCA_ACA_CAMPAIGN_Completed`, `MOCA_ACA_CAMPAIGN_Cancelled` or `MOCA_ACA_CAMPAIGN_Failed`).
+ * @param pacaStatArray Results of the finished ACA runs, in the order the runs were requested. The `acaCfg` and `stat`
+ *                      members of each entry identify the run and its outcome. The array is valid only for the duration of the callback.
+ * @param numEntries Number of entries in `pacaStatArray`.
+ * @param userData The user data pointer passed to `moca_startIfAcaCampaign()`.
+ */
+typedef void (*moca_aca_campaign_callback)(int interfaceIndex, moca_aca_campaign_state_t state, const moca_aca_stat_t *pacaStatArray, int numEntries, void *userData);
+
+/**
+ * @brief Configuration of the spectrum interference analyzer.
+ */
+typedef struct
+{
+    UINT MaxChannels;          /**< Number of channels for which a history is kept (1 to `kMoca_MaxSpectrumChannels`) */
+    UINT HistoryDepth;         /**< Number of power profiles kept per channel (`PersistenceCount` + 1 to 255) */
+    UINT BaselinePercentile;   /**< Per-bin percentile used as baseline, taken over all but the latest `PersistenceCount` profiles of a channel (0-100) */
+    INT AnomalyThresholdDb;    /**< Excess over the baseline, in dB, above which a bin is anomalous */
+    UINT PersistenceCount;     /**< Number of latest consecutive profiles in which a bin must be anomalous to be reported as a persistent interferer (at least 1) */
+} moca_spectrum_cfg_t;
+
+/**
+ * @brief A persistent interferer detected by the spectrum analyzer.
+ */
+typedef struct
+{
+    UINT Channel;        /**< Channel of the power profile the peak was found in (`Channel` of `moca_aca_cfg_t`) */
+    UINT Bin;            /**< Index of the peak bin in the power profile (0 to `kMoca_AcaProfileBins` - 1) */
+    INT PowerDbm;        /**< Power of the peak bin in the latest profile (dBm) */
+    INT BaselineDbm;     /**< Baseline power of the peak bin (dBm) */
+    UINT Persistence;    /**< Number of consecutive profiles in which the bin has been anomalous */
+} moca_spectrum_peak_t;
+
+/**
+ * @brief Result of `moca_SpectrumAnalyze()`.
+ */
+typedef struct
+{
+    UINT NumProfiles;                                /**< Number of power profiles currently held in the baseline, over all channels */
+    UINT NumAnomalousBins;                           /**< Number of bins above the anomaly threshold in the latest profiles */
+    UINT NumPeaks;                                   /**< Number of valid entries in `Peaks` */
+    moca_spectrum_peak_t Peaks[kMoca_MaxSpectrumPeaks]; /**< Persistent interferers, sorted by descending excess over the baseline */
+    UCHAR NodeTabooMask[128];                        /**< Recommended `NodeTabooMask` for `moca_cfg_t`: frequencies with persistent interferers */
+    UCHAR ChannelScanMask[128];                      /**< Recommended `ChannelScanMask` for `moca_cfg_t`: assessed frequencies free of persistent interferers */
+} moca_spectrum_report_t;
+
 /** @} */  //END OF GROUP MOCA_HAL_TYPES
 
 /**
@@ -644,11 +1050,13 @@ INT moca_GetMocaCPEs(ULONG ifIndex, moca_cpe_t *cpes, INT *pnum_cpes);
  * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
  * @param[out] ppdevice_array Pointer to a pointer that will be populated with an array of `moca_associated_device_t` structures. 
  *                            Each structure in the array contains information about a single associated device. 
- *                            The caller is responsible for allocating memory for this array.
+ *                            The array is allocated by the HAL with `malloc()` and the caller must release it with `free()`.
  *
  * @return Status of the operation.
  * @retval STATUS_SUCCESS - The operation was successful.
  * @retval STATUS_FAILURE - An error occurred during the operation.
+ *
+ * @note New code should use `moca_GetAssociatedDevicesPooled()` when `MOCA_CAP_POOLED_RESULTS` is set.
  */
 INT moca_GetAssociatedDevices(ULONG ifIndex, moca_associated_device_t **ppdevice_array);
 
@@ -743,12 +1151,16 @@ INT moca_GetResetCount(ULONG *resetcnt);
  * @retval STATUS_SUCCESS  - The ACA process was successfully configured and started (if `ACAStart` was TRUE).
  * @retval STATUS_FAILURE  - An error occurred during configuration or initialization.
  * @retval STATUS_INPROGRESS - An ACA process is already running on the interface.
+ * @retval STATUS_BUSY - An ACA campaign is running on the interface (only when `MOCA_CAP_ACA_CAMPAIGN` is reported).
  *
  * @note
  *    * If the `ACAStart` flag in `acaCfg` is set to `TRUE`, the ACA process will begin immediately.
  *    * If `ACAStart` is `FALSE`, only the configuration parameters will be set, and the ACA process won't start.
  *    * If an ACA process is already in progress on the interface, this function will return `STATUS_INPROGRESS`
  *      and will not start a new ACA process.
+ *    * `STATUS_INPROGRESS` has the same value as `STATUS_FAILURE`. A HAL that reports `MOCA_CAP_ACA_CAMPAIGN` returns
+ *      `STATUS_BUSY` instead while a campaign started with `moca_startIfAcaCampaign()` is running, and does not
+ *      change the campaign.
  */
 int moca_setIfAcaConfig(int interfaceIndex, moca_aca_cfg_t acaCfg);
 
@@ -773,6 +1185,10 @@ int moca_getIfAcaConfig(int interfaceIndex, moca_aca_cfg_t *acaCfg);
  * This function terminates a currently running ACA process on the specified MoCA interface. 
  * If no ACA process is active, it has no effect.
  *
+ * If the run belongs to an ACA campaign started with `moca_startIfAcaCampaign()`, the whole campaign ends as if
+ * `moca_cancelIfAcaCampaign()` had been called: the remaining runs are discarded and the campaign callback is
+ * invoked with `MOCA_ACA_CAMPAIGN_Cancelled`.
+ *
  * @param[in] interfaceIndex The index of the MoCA interface where the ACA process is running.
  *
  * @return Status of the operation:
@@ -807,14 +1223,648 @@ int moca_getIfAcaStatus(int interfaceIndex,moca_aca_stat_t *pacaStat);
  * @param[out] pnumOfEntries Pointer to an integer that will be filled with the number of entries in the `ppscmodStat` array.
  * @param[out] ppscmodStat Pointer to a pointer that will be populated with an array of `moca_scmod_stat_t` structures. 
  *                         Each structure contains SCMOD statistics for a pair of nodes on the MoCA network. 
- *                         The caller is responsible for allocating memory for this array.
+ *                         The array is allocated by the HAL with `malloc()` and the caller must release it with `free()`.
  *
  * @return Status of the operation:
  * @retval STATUS_SUCCESS - The operation was successful, and SCMOD statistics were retrieved.
  * @retval STATUS_FAILURE - An error occurred during the operation, and no valid SCMOD information was obtained.
+ *
+ * @note New code should use `moca_getIfScmodPooled()` when `MOCA_CAP_POOLED_RESULTS` is set.
  */
 int moca_getIfScmod(int interfaceIndex,int *pnumOfEntries,moca_scmod_stat_t **ppscmodStat);
 
+/**********************************************************************************
+ *
+ *  MoCA HAL memory management function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Retrieves information about all associated devices on the MoCA network into a pooled array.
+ *
+ * This function returns the same information as `moca_GetAssociatedDevices()`, but the array is taken from
+ * the HAL result pool and its number of entries is returned by the same call.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[out] ppdevice_array Pointer to a pointer that will be populated with an array of `moca_associated_device_t` structures.
+ *                            The caller must release the array with `moca_FreeAssociatedDevices()`, never with `free()`.
+ * @param[out] pulCount Pointer to an unsigned long integer to store the number of entries in `*ppdevice_array` (0 to `kMoca_MaxMocaNodes`).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation. `*ppdevice_array` is set to NULL and `*pulCount` to 0.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_POOLED_RESULTS` is not supported.
+ */
+INT moca_GetAssociatedDevicesPooled(ULONG ifIndex, moca_associated_device_t **ppdevice_array, ULONG *pulCount);
+
+/**
+ * @brief Retrieves MoCA Subcarrier Modulation (SCMOD) statistics into a pooled array.
+ *
+ * This function returns the same information as `moca_getIfScmod()`, but the array is taken from the HAL result pool.
+ *
+ * @param[in] interfaceIndex The index of the MoCA interface.
+ * @param[out] pnumOfEntries Pointer to an integer that will be filled with the number of entries in `*ppscmodStat` (0 to `kMoca_MaxScmodEntries`).
+ * @param[out] ppscmodStat Pointer to a pointer that will be populated with an array of `moca_scmod_stat_t` structures.
+ *                         The caller must release the array with `moca_freeIfScmod()`, never with `free()`.
+ *
+ * @return Status of the operation:
+ * @retval STATUS_SUCCESS - The operation was successful, and SCMOD statistics were retrieved.
+ * @retval STATUS_FAILURE - An error occurred during the operation. `*ppscmodStat` is set to NULL and `*pnumOfEntries` to 0.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_POOLED_RESULTS` is not supported.
+ */
+int moca_getIfScmodPooled(int interfaceIndex, int *pnumOfEntries, moca_scmod_stat_t **ppscmodStat);
+
+/**
+ * @brief Releases an associated device array returned by `moca_GetAssociatedDevicesPooled()`.
+ *
+ * The array is returned to the HAL result pool so that subsequent polls reuse the same memory
+ * instead of allocating from the system heap.
+ *
+ * @param[in] pdevice_array Array previously returned through `ppdevice_array`. Passing NULL has no effect.
+ *
+ * @note The array must not be accessed after this call. Arrays returned by the legacy
+ *       `moca_GetAssociatedDevices()` must not be passed to this function.
+ */
+void moca_FreeAssociatedDevices(moca_associated_device_t *pdevice_array);
+
+/**
+ * @brief Releases an SCMOD statistics array returned by `moca_getIfScmodPooled()`.
+ *
+ * The array is returned to the HAL result pool so that subsequent polls reuse the same memory
+ * instead of allocating from the system heap.
+ *
+ * @param[in] pscmodStat Array previously returned through `ppscmodStat`. Passing NULL has no effect.
+ *
+ * @note The array must not be accessed after this call. Arrays returned by the legacy
+ *       `moca_getIfScmod()` must not be passed to this function.
+ */
+void moca_freeIfScmod(moca_scmod_stat_t *pscmodStat);
+
+/**
+ * @brief Retrieves the current and peak memory usage of the MoCA HAL.
+ *
+ * This function reports the current and peak memory footprint of the HAL in the calling process, including
+ * the result pool, heap fallbacks and internal state, allowing callers to verify that memory consumption
+ * stays bounded over long uptimes and to detect unreleased result arrays.
+ *
+ * @param[out] pusage Pointer to a `moca_mem_usage_t` structure to store the memory usage.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_GetHalMemoryUsage(moca_mem_usage_t *pusage);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL capability discovery function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Retrieves the optional APIs and fields supported by the MoCA HAL on an interface.
+ *
+ * This function allows a single consumer binary to decide at startup which optional HAL functionality
+ * to use, instead of relying on the compile-time `MOCA_VAR` exclusions. Consumers are expected to call
+ * it once per interface and cache the result.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[out] pcapabilities Pointer to a `moca_capabilities_t` structure to store the supported capabilities.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ *
+ * @note A capability bit that is not set means the corresponding API returns `STATUS_NOT_AVAILABLE`
+ *       or the corresponding field is not populated; callers must not rely on it.
+ * @note This function is available regardless of whether `MOCA_VAR` is defined.
+ */
+INT moca_GetCapabilities(ULONG ifIndex, moca_capabilities_t *pcapabilities);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL binary logging function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Sets the most verbose log level that is recorded.
+ *
+ * Entries with a level numerically greater than `level` are discarded by `moca_LogRecord()` before any work is done.
+ *
+ * @param[in] level The most verbose level to record (see `moca_log_level_t`).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_INVALID_PARAM - `level` is out of range.
+ */
+INT moca_LogSetLevel(moca_log_level_t level);
+
+/**
+ * @brief Retrieves the most verbose log level that is recorded.
+ *
+ * @return The current log level (see `moca_log_level_t`).
+ */
+moca_log_level_t moca_LogGetLevel(void);
+
+/**
+ * @brief Records a binary log entry for a HAL call.
+ *
+ * The entry is time-stamped and copied into a ring owned by the calling thread. No formatting, locking
+ * or I/O takes place on the calling thread; the entry is written to the binary log file later by the
+ * background flusher. This makes the function suitable for use on every HAL call, including at `MOCA_LOG_TRACE`.
+ *
+ * @param[in] level Log level of the entry (see `moca_log_level_t`).
+ * @param[in] callId HAL call that produced the entry: a `moca_call_id_t` value, or a vendor-internal identifier
+ *                   at or above `MOCA_CALL_Vendor`.
+ * @param[in] status Return value of the HAL call, or 0 if not applicable.
+ * @param[in] numArgs Number of elements in `pargs` (0 to `kMoca_LogMaxArgs`); extra elements are ignored.
+ * @param[in] pargs Array of call arguments or results to record. May be NULL if `numArgs` is 0.
+ *
+ * @note This function never blocks. If the ring of the calling thread is full, or the thread has no ring because
+ *       `kMoca_LogMaxRings` rings are in use, the entry is dropped and counted in `EntriesDropped` of `moca_log_stats_t`.
+ */
+void moca_LogRecord(moca_log_level_t level, UINT callId, INT status, UINT numArgs, const unsigned long long *pargs);
+
+/**
+ * @brief Writes all pending binary log entries to the binary log file.
+ *
+ * The background flusher calls this periodically; callers only need it before an orderly shutdown
+ * or when collecting logs on demand.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - All pending entries were written.
+ * @retval STATUS_FAILURE - An error occurred while writing the binary log file.
+ */
+INT moca_LogFlush(void);
+
+/**
+ * @brief Retrieves binary logging statistics.
+ *
+ * @param[out] pstats Pointer to a `moca_log_stats_t` structure to store the statistics.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_LogGetStats(moca_log_stats_t *pstats);
+
+/**
+ * @brief Formats a binary log entry as a zero-terminated text line.
+ *
+ * The text contains the timestamp, the log level, the name of the HAL call, its status and its arguments,
+ * in the format used for `moca_vendor_hal.log`.
+ *
+ * @param[in] pentry Pointer to the `moca_log_entry_t` to format.
+ * @param[out] pbuf Buffer to store the formatted text.
+ * @param[in] bufLen Size of `pbuf` in bytes. The text is truncated if it does not fit.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - `pentry` or `pbuf` is invalid.
+ */
+INT moca_LogDecodeEntry(const moca_log_entry_t *pentry, CHAR *pbuf, UINT bufLen);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL background sampling function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Sets the sampling schedule requested by the calling process for one data class on a MoCA interface.
+ *
+ * Every process that has started sampling holds its own requested schedule, which starts from the
+ * `kMoca_SampleDefault*` values. The collector samples a class if any process enables it, at the shortest
+ * `IntervalMs` requested by those processes, so a request can never slow down or disable sampling for another
+ * process. Samples are delivered to the sinks of each process at that process's own requested interval.
+ * The request is dropped when the process stops sampling or exits.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pschedule Pointer to the `moca_sample_schedule_t` to apply.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_INVALID_PARAM - The schedule is invalid (e.g. `IntervalMs` is below `kMoca_SampleMinIntervalMs` or `BackoffMaxMs` is below `BackoffInitialMs`).
+ * @retval STATUS_NOT_AVAILABLE - The data class is not supported on this interface (see `moca_GetCapabilities()`).
+ */
+INT moca_SamplerSetSchedule(ULONG ifIndex, const moca_sample_schedule_t *pschedule);
+
+/**
+ * @brief Retrieves the sampling schedule requested by the calling process for one data class on a MoCA interface.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] sampleClass The data class to query.
+ * @param[out] pschedule Pointer to a `moca_sample_schedule_t` structure to store the schedule.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_SamplerGetSchedule(ULONG ifIndex, moca_sample_class_t sampleClass, moca_sample_schedule_t *pschedule);
+
+/**
+ * @brief Registers a sink to receive samples from the background sampler.
+ *
+ * The callback is invoked on a HAL thread of the calling process after every sample of a class selected in
+ * `classMask`, on every interface the process has started sampling on, whether the sample was taken by this
+ * process or received from the collector process. It must return quickly and must not call back into the sampler.
+ *
+ * @param[in] classMask Bitmask of data classes to receive, where bit `n` selects `moca_sample_class_t` value `n`.
+ * @param[in] callback_proc Pointer to the callback function of type `moca_sample_sink_callback`.
+ * @param[in] userData Opaque pointer passed back to the callback.
+ * @param[out] psinkId Pointer to an integer to store the identifier of the registered sink.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_SamplerRegisterSink(ULONG classMask, moca_sample_sink_callback callback_proc, void *userData, INT *psinkId);
+
+/**
+ * @brief Unregisters a sink registered with `moca_SamplerRegisterSink()`.
+ *
+ * When this function returns, the callback is no longer running and will not be invoked again.
+ *
+ * @param[in] sinkId Identifier returned by `moca_SamplerRegisterSink()`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - `sinkId` is not registered.
+ */
+INT moca_SamplerUnregisterSink(INT sinkId);
+
+/**
+ * @brief Starts background sampling on a MoCA interface.
+ *
+ * Only one process in the system polls the driver for an interface. If no process is collecting for the
+ * interface yet, the calling process becomes the collector; otherwise it attaches to the existing collector
+ * and receives its samples without calling the driver.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - Sampling was started or was already running.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_SamplerStart(ULONG ifIndex);
+
+/**
+ * @brief Stops background sampling on a MoCA interface.
+ *
+ * The calling process stops receiving samples for the interface. If it was the collector, one of the
+ * remaining attached processes takes over, and the requested schedules of the remaining processes are kept.
+ * Registered sinks are retained and
+ * apply again on the next `moca_SamplerStart()`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - Sampling was stopped or was not running.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_SamplerStop(ULONG ifIndex);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL topology model function prototypes
+ *
+**********************************************************************************/
+
+#ifndef MOCA_VAR
+/**
+ * @brief Updates the topology model with the dynamic information of a MoCA interface.
+ *
+ * The NC, backup NC and local node IDs are taken from the structure.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pmoca_dynamic_info Pointer to a `moca_dynamic_info_t` returned by `moca_IfGetDynamicInfo()`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ *
+ * @note This function is only available when the `MOCA_VAR` macro is not defined.
+ */
+INT moca_TopoUpdateDynamicInfo(ULONG ifIndex, const moca_dynamic_info_t *pmoca_dynamic_info);
+
+/**
+ * @brief Updates the topology model with the full mesh PHY rate table of a MoCA interface.
+ *
+ * Links present in the table replace the previous rates; links between nodes that are no longer
+ * present in the table are removed.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pDeviceArray Pointer to the `moca_mesh_table_t` array returned by `moca_GetFullMeshRates()`.
+ * @param[in] ulCount Number of entries in `pDeviceArray`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ *
+ * @note This function is only available when the `MOCA_VAR` macro is not defined.
+ */
+INT moca_TopoUpdateMeshRates(ULONG ifIndex, const moca_mesh_table_t *pDeviceArray, ULONG ulCount);
+#endif
+
+/**
+ * @brief Updates the topology model with the associated devices of a MoCA interface.
+ *
+ * `PHYTxRate` and `PHYRxRate` of each device provide the rates of the links between the local node, identified
+ * by `localNodeID`, and that device. They are used for those links when no mesh rate table is available.
+ * `PreferredNC` and `HighestVersion` of each device provide its NC ranking inputs, as described for
+ * `moca_TopoUpdatePncInfo()`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] localNodeID Node ID of the local node (`NodeID` of `moca_dynamic_info_t`, or the platform's equivalent
+ *                        when `MOCA_VAR` is defined).
+ * @param[in] pdevice_array Pointer to the `moca_associated_device_t` array returned by `moca_GetAssociatedDevices()`.
+ * @param[in] ulCount Number of entries in `pdevice_array`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_TopoUpdateAssociatedDevices(ULONG ifIndex, ULONG localNodeID, const moca_associated_device_t *pdevice_array, ULONG ulCount);
+
+/**
+ * @brief Updates the topology model with the preferred NC information of the MoCA nodes.
+ *
+ * No HAL API returns `moca_assoc_pnc_info_t`; `moca_TopoUpdateAssociatedDevices()` already derives it for remote
+ * nodes (`mocaNodeIndex` from `NodeID`, `mocaNodePreferredNC` from `PreferredNC`, `mocaNodeMocaversion` from
+ * `HighestVersion`, e.g. "2.0" becomes 20). This function is needed only for nodes not covered by that call,
+ * typically the local node, whose entry the caller builds from `bPreferredNC` of `moca_cfg_t` and `HighestVersion`
+ * of `moca_static_info_t`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pPncArray Pointer to an array of `moca_assoc_pnc_info_t` structures, one per node.
+ * @param[in] ulCount Number of entries in `pPncArray`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_TopoUpdatePncInfo(ULONG ifIndex, const moca_assoc_pnc_info_t *pPncArray, ULONG ulCount);
+
+/**
+ * @brief Sets the threshold above which a link is flagged as asymmetric.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] thresholdPercent Difference between the two directions of a link, in percent of the faster direction (1-100).
+ *                             The default is `kMoca_TopoDefaultAsymmetryPercent`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_INVALID_PARAM - `thresholdPercent` is out of range.
+ */
+INT moca_TopoSetAsymmetryThreshold(ULONG ifIndex, UINT thresholdPercent);
+
+/**
+ * @brief Retrieves the capacity of the link between two MoCA nodes.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] txNodeID Transmitting node ID.
+ * @param[in] rxNodeID Receiving node ID.
+ * @param[in] profile PHY rate profile to report (see `moca_rate_profile_t`).
+ * @param[out] plink Pointer to a `moca_topo_link_t` structure to store the link capacity.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_NODE_NOT_FOUND - One of the nodes is not present in the topology model.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_TOPOLOGY` is not supported, or `profile` requires `MOCA_CAP_MESH_NPER_VLPER`.
+ */
+INT moca_TopoGetLinkCapacity(ULONG ifIndex, ULONG txNodeID, ULONG rxNodeID, moca_rate_profile_t profile, moca_topo_link_t *plink);
+
+/**
+ * @brief Retrieves the weakest links of the MoCA network.
+ *
+ * Each pair of nodes is reported once, sorted by ascending `BottleneckRate`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] profile PHY rate profile to evaluate (see `moca_rate_profile_t`).
+ * @param[out] pLinkArray Pointer to a caller allocated `moca_topo_link_t` array to store the links.
+ * @param[in] maxLinks Number of entries `pLinkArray` can hold; `kMoca_MaxTopoLinks` is always sufficient. If more links
+ *                     qualify, only the first `maxLinks` in sort order are written.
+ * @param[out] pulCount Pointer to an unsigned long integer to store the number of entries written to `pLinkArray`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_TOPOLOGY` is not supported, or `profile` requires `MOCA_CAP_MESH_NPER_VLPER`.
+ */
+INT moca_TopoGetWeakestLinks(ULONG ifIndex, moca_rate_profile_t profile, moca_topo_link_t *pLinkArray, ULONG maxLinks, ULONG *pulCount);
+
+/**
+ * @brief Retrieves the asymmetric links of the MoCA network.
+ *
+ * Each pair of nodes is reported once, sorted by descending difference between the two directions.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] profile PHY rate profile to evaluate (see `moca_rate_profile_t`).
+ * @param[out] pLinkArray Pointer to a caller allocated `moca_topo_link_t` array to store the links.
+ * @param[in] maxLinks Number of entries `pLinkArray` can hold; `kMoca_MaxTopoLinks` is always sufficient. If more links
+ *                     qualify, only the first `maxLinks` in sort order are written.
+ * @param[out] pulCount Pointer to an unsigned long integer to store the number of entries written to `pLinkArray`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_TOPOLOGY` is not supported, or `profile` requires `MOCA_CAP_MESH_NPER_VLPER`.
+ */
+INT moca_TopoGetAsymmetricLinks(ULONG ifIndex, moca_rate_profile_t profile, moca_topo_link_t *pLinkArray, ULONG maxLinks, ULONG *pulCount);
+
+/**
+ * @brief Ranks the MoCA nodes as Network Coordinator (NC) candidates.
+ *
+ * Candidates are sorted best first: nodes configured as preferred NC, then nodes supporting the highest
+ * MoCA version, then nodes with the highest `MinRate`, then nodes with the highest `AvgRate`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] profile PHY rate profile to evaluate (see `moca_rate_profile_t`).
+ * @param[out] pCandidateArray Pointer to a caller allocated `moca_topo_nc_candidate_t` array to store the candidates, best first.
+ * @param[in] maxCandidates Number of entries `pCandidateArray` can hold; `kMoca_MaxMocaNodes` is always sufficient. If there
+ *                          are more candidates, only the best `maxCandidates` are written.
+ * @param[out] pulCount Pointer to an unsigned long integer to store the number of entries written to `pCandidateArray`.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_TOPOLOGY` is not supported, or `profile` requires `MOCA_CAP_MESH_NPER_VLPER`.
+ */
+INT moca_TopoRankNcCandidates(ULONG ifIndex, moca_rate_profile_t profile, moca_topo_nc_candidate_t *pCandidateArray, ULONG maxCandidates, ULONG *pulCount);
+
+/**
+ * @brief Clears the topology model of a MoCA interface.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_TopoReset(ULONG ifIndex);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL ACA campaign function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Starts a campaign of consecutive MoCA Automatic Channel Adaptation (ACA) runs.
+ *
+ * Each entry of `pacaCfgArray` describes one ACA run (node, probe type, channel and report nodes); the `ACAStart`
+ * member is ignored. The HAL starts each run as soon as the previous one has finished and invokes `callback_proc`
+ * once with the results of all runs when the campaign ends.
+ *
+ * @param[in] interfaceIndex The index of the MoCA interface.
+ * @param[in] pacaCfgArray Array of `moca_aca_cfg_t` structures, one per ACA run. The array is copied before the function returns.
+ * @param[in] numSteps Number of entries in `pacaCfgArray` (1 to `kMoca_MaxAcaCampaignSteps`).
+ * @param[in] callback_proc Pointer to the callback function of type `moca_aca_campaign_callback`.
+ * @param[in] userData Opaque pointer passed back to the callback.
+ * @param[out] pfailedStep Pointer to an integer to store the index in `pacaCfgArray` of the run that was rejected
+ *                         with `STATUS_NODE_NOT_FOUND`, `STATUS_INVALID_PROBE` or `STATUS_INVALID_CHAN`, or -1 otherwise. May be NULL.
+ *
+ * @return Status of the operation:
+ * @retval STATUS_SUCCESS - The campaign was started.
+ * @retval STATUS_FAILURE - An internal error occurred; the request may be retried.
+ * @retval STATUS_NOT_AVAILABLE - `MOCA_CAP_ACA_CAMPAIGN` is not supported.
+ * @retval STATUS_BUSY - A campaign or a single ACA run is already in progress on the interface; retry later.
+ * @retval STATUS_INVALID_PARAM - `pacaCfgArray` or `callback_proc` is NULL, or `numSteps` is out of range.
+ * @retval STATUS_NODE_NOT_FOUND - The run at `*pfailedStep` refers to a MoCA node that does not exist.
+ * @retval STATUS_INVALID_PROBE - The run at `*pfailedStep` uses an invalid probe type.
+ * @retval STATUS_INVALID_CHAN - The run at `*pfailedStep` uses an invalid channel.
+ *
+ * @note All runs are validated before the first one is started; if any is invalid, no run is started.
+ * @note Unlike `moca_setIfAcaConfig()`, every return value of this function is distinct.
+ */
+int moca_startIfAcaCampaign(int interfaceIndex, const moca_aca_cfg_t *pacaCfgArray, int numSteps, moca_aca_campaign_callback callback_proc, void *userData, int *pfailedStep);
+
+/**
+ * @brief Cancels an ACA campaign in progress.
+ *
+ * The ACA run in progress is stopped in the driver and the remaining runs are discarded.
+ * The campaign callback is invoked with `MOCA_ACA_CAMPAIGN_Cancelled` and the results of the runs that had finished.
+ *
+ * @param[in] interfaceIndex The index of the MoCA interface.
+ *
+ * @return Status of the operation:
+ * @retval STATUS_SUCCESS - The campaign was cancelled or was not running.
+ * @retval STATUS_FAILURE - An error occurred while attempting to cancel the campaign.
+ */
+int moca_cancelIfAcaCampaign(int interfaceIndex);
+
+/**
+ * @brief Retrieves the progress of the current or last ACA campaign.
+ *
+ * @param[in] interfaceIndex The index of the MoCA interface.
+ * @param[out] pstatus Pointer to a `moca_aca_campaign_status_t` structure to store the campaign progress.
+ *
+ * @return Status of the operation:
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+int moca_getIfAcaCampaignStatus(int interfaceIndex, moca_aca_campaign_status_t *pstatus);
+
+/**********************************************************************************
+ *
+ *  MoCA HAL spectrum analyzer function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Sets the configuration of the spectrum analyzer of a MoCA interface.
+ *
+ * The history of `MaxChannels` channels of `HistoryDepth` profiles each is allocated here, so the memory used by the
+ * analyzer is fixed until the next configuration. Changing `MaxChannels` or `HistoryDepth` discards the held profiles.
+ * Until a configuration is set, `kMoca_SpectrumDefaultChannels` and the `kMoca_SpectrumDefault*` values apply.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pcfg Pointer to the `moca_spectrum_cfg_t` to apply.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - The history could not be allocated.
+ * @retval STATUS_INVALID_PARAM - A field is out of range, including `HistoryDepth` not greater than `PersistenceCount`.
+ */
+INT moca_SpectrumSetConfig(ULONG ifIndex, const moca_spectrum_cfg_t *pcfg);
+
+/**
+ * @brief Adds the power profile of a completed ACA run to the rolling baseline.
+ *
+ * The profile is filed under the `Channel` of the ACA configuration and replaces the oldest profile of that
+ * channel once `HistoryDepth` profiles are held. A history is created for a channel on its first profile,
+ * as long as fewer than `MaxChannels` channels are held.
+ *
+ * `moca_getIfAcaStatus()` keeps returning the last completed run until a new one finishes, so the same profile
+ * may be passed more than once. A profile whose `acaCfg`, `RxPower` and `ACAPowProfile` are identical to the latest
+ * profile held for its channel is ignored, so that a repeated poll cannot count as a new observation.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] pacaStat Pointer to a `moca_aca_stat_t` returned by `moca_getIfAcaStatus()` or an ACA campaign callback.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The profile was added, or was identical to the latest profile of its channel and ignored.
+ * @retval STATUS_FAILURE - The ACA run did not succeed or `ACATrapCompleted` is FALSE; the profile was ignored.
+ * @retval STATUS_NO_RESOURCES - The channel is new and `MaxChannels` channels are already held; the profile was ignored.
+ *                               Call `moca_SpectrumReset()` or raise `MaxChannels` to assess other channels.
+ */
+INT moca_SpectrumAddProfile(ULONG ifIndex, const moca_aca_stat_t *pacaStat);
+
+/**
+ * @brief Retrieves a per-bin percentile of the power profiles held for a channel.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] channel Channel whose history is evaluated.
+ * @param[in] percentile Percentile to compute (0-100).
+ * @param[out] pProfile Pointer to a caller allocated array of `kMoca_AcaProfileBins` integers to store the percentile of each bin (dBm).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ * @retval STATUS_INVALID_PARAM - `percentile` is out of range.
+ * @retval STATUS_INVALID_CHAN - No profile is held for `channel`.
+ */
+INT moca_SpectrumGetPercentile(ULONG ifIndex, UINT channel, UINT percentile, INT *pProfile);
+
+/**
+ * @brief Compares the latest power profiles against the rolling baseline and recommends channel masks.
+ *
+ * For every channel with history, the baseline is the `BaselinePercentile` of each bin over the older profiles,
+ * excluding the latest `PersistenceCount` ones, so that a new persistent interferer cannot raise its own baseline.
+ * Bins exceeding the baseline by `AnomalyThresholdDb` in each of the latest `PersistenceCount` profiles are reported
+ * as persistent interferers, and the masks in the report are derived from them.
+ *
+ * A channel holding `PersistenceCount` profiles or fewer has no baseline yet and is skipped: it reports no
+ * anomalous bins or peaks, and its frequencies are not marked as assessed in `ChannelScanMask`.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ * @param[in] currentOperFreq Current operating frequency of the interface (`CurrentOperFreq` of `moca_dynamic_info_t`),
+ *                            which is never placed in the recommended taboo mask; 0 if unknown.
+ * @param[out] preport Pointer to a `moca_spectrum_report_t` structure to store the analysis.
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ *
+ * @note The masks are only recommendations. To apply them, copy them into `moca_cfg_t` and call `moca_SetIfConfig()`.
+ */
+INT moca_SpectrumAnalyze(ULONG ifIndex, ULONG currentOperFreq, moca_spectrum_report_t *preport);
+
+/**
+ * @brief Discards all power profiles held by the spectrum analyzer of a MoCA interface.
+ *
+ * @param[in] ifIndex The index of the MoCA interface (0 for a single interface, 1-256 for multiple interfaces).
+ *
+ * @return Status of the operation.
+ * @retval STATUS_SUCCESS - The operation was successful.
+ * @retval STATUS_FAILURE - An error occurred during the operation.
+ */
+INT moca_SpectrumReset(ULONG ifIndex);
+
 /** @} */  //END OF GROUP MOCA_HAL_APIS
 #endif
 